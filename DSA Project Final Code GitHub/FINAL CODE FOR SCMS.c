@@ -2,93 +2,69 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
-#include <ctype.h>
-
-unsigned int lastCustomerId = 0;
-
-// Forward declarations
-struct Customer;
-struct Booking;
-
-struct Customer* createCustomer(char name[], char email[], char phoneNumber[], char address[], int age);
-struct Booking* createBooking(int customerId, int sport, int timeSlot);
-void addCustomer(struct Customer** head, struct Customer* newCustomer);
-void addBooking(struct Booking** head, struct Booking* newBooking);
-int listAvailableSports(struct Booking* bookingList, int *selectedSport, int *selectedTimeSlot);
-void registerCustomer(struct Customer **customerHead, unsigned int *lastCustomerId);
-void bookSlot(struct Customer* customerHead, struct Booking** bookingHead, unsigned int *lastCustomerId);
-bool isValidEmail(const char *email);
-bool isValidPhoneNumber(const char *phoneNumber);
-bool isValidAddress(const char *address);
-void displayBookedSlots(struct Booking* bookingHead, struct Customer* customerHead);
-void freeCustomers(struct Customer* head);
-void freeBookings(struct Booking* head);
-void listCustomerInfo(struct Customer* head);
-void searchCustomer(struct Customer* customerHead, struct Booking* bookingHead);
-void deleteCustomer(struct Customer** customerHead, struct Booking** bookingHead, const char* deleteName);
-void cancelBooking(struct Booking** bookingHead, struct Customer* customerHead, const char* cancelName);
-const char* sportName(int sport);
-struct Customer* findCustomerByName(struct Customer* head, const char* name);
-struct Customer* findCustomerById(struct Customer* head, int id);
-bool hasBookingInSport(struct Booking* bookingHead, int customerId, int sport);
-
-struct Customer {
-    int customerId;
-    char name[50];
-    char email[50];
-    char phoneNumber[15];
-    char address[100];
-    int age;
-    struct Customer* next;
-};
-
-struct Booking {
-    int bookingId;
-    int customerId;
-    int sport;
-    int timeSlot;
-    struct Booking* next;
-};
-
-int listAvailableSports(struct Booking* bookingList, int *selectedSport, int *selectedTimeSlot) {
-    printf("Available Time Slots for Different Sports (2 hours each, 8 AM to 8 PM):\n");
-
-    const int openingHour = 8;
-    const int closingHour = 20;
-    const int slotDuration = 2;
-    const int slotsPerSport = 6;
-    const int maxCustomersPerSlot = 3;
-
-    // Initialize the array to keep track of the number of customers booked for each slot
-    int bookedSlotsCount[6][6] = {0}; // [sport][timeSlot]
-
-    // Update booked slots count based on the existing bookings
-    struct Booking* current = bookingList;
-    while (current != NULL) {
-        if (current->sport >= 1 && current->sport <= 6 && 
-            current->timeSlot >= 1 && current->timeSlot <= 6) {
-            bookedSlotsCount[current->sport - 1][current->timeSlot - 1]++;
-        }
-        current = current->next;
+#include <time.h>
+
+#include "scms_engine.h"
+
+// Terminal front end. All business rules live in the engine (scms_engine.c);
+// the functions here only prompt, call the engine and print the outcome.
+
+ScmsTime currentCentreTime(void);
+const char* formatDay(int day, char* buffer, size_t size);
+int listAvailableSports(const struct SportsCentre* centre, int day, int *selectedSport, int *selectedTimeSlot);
+void registerCustomer(struct SportsCentre* centre);
+void bookSlot(struct SportsCentre* centre);
+void displayBookedSlots(const struct SportsCentre* centre);
+void listCustomerInfo(const struct SportsCentre* centre);
+void searchCustomer(const struct SportsCentre* centre);
+void deleteCustomer(struct SportsCentre* centre, const char* deleteName);
+void cancelBooking(struct SportsCentre* centre, const char* cancelName);
+void displayBookingHistory(const struct SportsCentre* centre);
+
+// Engine day numbers are local calendar days counted from 1970-01-01
+ScmsTime currentCentreTime(void) {
+    time_t now = time(NULL);
+    struct tm* local = localtime(&now);
+    long year = local->tm_year + 1900L;
+    long day = 365 * (year - 1970) + (year - 1969) / 4 - (year - 1901) / 100 + (year - 1601) / 400 + local->tm_yday;
+    return (ScmsTime)day * SCMS_HOURS_PER_DAY + local->tm_hour;
+}
+
+const char* formatDay(int day, char* buffer, size_t size) {
+    time_t midnight = (time_t)day * 86400;
+    strftime(buffer, size, "%d-%m-%Y", gmtime(&midnight));
+    return buffer;
+}
+
+int listAvailableSports(const struct SportsCentre* centre, int day, int *selectedSport, int *selectedTimeSlot) {
+    struct SlotAvailability availability;
+    if (scmsGetAvailability(centre, day, &availability) != SCMS_OK) {
+        printf("Bookings can only be made from today up to %d days ahead.\n", SCMS_BOOKING_HORIZON_DAYS - 1);
+        return 0;
     }
 
-    for (int i = 1; i <= 6; i++) {
+    char date[16];
+    printf("Available Time Slots on %s (2 hours each, 8 AM to 8 PM):\n", formatDay(day, date, sizeof(date)));
+
+    for (int i = 1; i <= SCMS_SPORT_COUNT; i++) {
         printf("%d. %s: ", i, sportName(i));
 
-        for (int j = 0; j < slotsPerSport; j++) {
-            int startTime = openingHour + j * slotDuration;
-            int endTime = startTime + slotDuration;
+        for (int j = 0; j < SCMS_SLOTS_PER_SPORT; j++) {
+            int startTime = slotStartHour(j + 1);
+            int endTime = slotEndHour(j + 1);
 
-            if (endTime <= closingHour) {
-                int availableSlots = maxCustomersPerSlot - bookedSlotsCount[i - 1][j];
+            if (endTime <= SCMS_CLOSING_HOUR) {
+                int availableSlots = availability.available[i - 1][j];
 
-                if (availableSlots > 0) {
+                if (!availability.open[j]) {
+                    printf("\n %d) %02d:00 - %02d:00 (Closed)", j + 1, startTime, endTime);
+                } else if (availableSlots > 0) {
                     printf("\n %d) %02d:00 - %02d:00 (%d slots available)", j + 1, startTime, endTime, availableSlots);
                 } else {
                     printf("\n %d) %02d:00 - %02d:00 (Fully booked)", j + 1, startTime, endTime);
                 }
 
-                if (j < slotsPerSport - 1) {
+                if (j < SCMS_SLOTS_PER_SPORT - 1) {
                     printf("; ");
                 }
             } else {
@@ -102,187 +78,51 @@ int listAvailableSports(struct Booking* bookingList, int *selectedSport, int *se
     do {
         printf("Enter the sport number to choose a time slot (1-6): ");
         scanf("%d", &chosenSport);
-        if (chosenSport < 1 || chosenSport > 6) {
+        if (chosenSport < 1 || chosenSport > SCMS_SPORT_COUNT) {
             printf("Invalid sport number. Please enter a number between 1 and 6.\n");
         }
-    } while (chosenSport < 1 || chosenSport > 6);
+    } while (chosenSport < 1 || chosenSport > SCMS_SPORT_COUNT);
 
     int chosenSlot;
     do {
         printf("Enter the desired time slot for %s (1-6): ", sportName(chosenSport));
         scanf("%d", &chosenSlot);
-        if (chosenSlot < 1 || chosenSlot > slotsPerSport) {
+        if (chosenSlot < 1 || chosenSlot > SCMS_SLOTS_PER_SPORT) {
             printf("Invalid time slot. Please enter a number between 1 and 6.\n");
         }
-    } while (chosenSlot < 1 || chosenSlot > slotsPerSport);
+    } while (chosenSlot < 1 || chosenSlot > SCMS_SLOTS_PER_SPORT);
 
     // Check if the slot is available
-    if (bookedSlotsCount[chosenSport - 1][chosenSlot - 1] >= maxCustomersPerSlot) {
+    if (!availability.open[chosenSlot - 1]) {
+        printf("Sorry, this time slot has already started. Please choose a later slot.\n");
+        return 0;
+    }
+    if (availability.available[chosenSport - 1][chosenSlot - 1] == 0) {
         printf("Sorry, this time slot is fully booked. Please choose another slot.\n");
         return 0;
     }
 
     *selectedSport = chosenSport;
     *selectedTimeSlot = chosenSlot;
-    
-    int startTime = openingHour + (chosenSlot - 1) * slotDuration;
-    int endTime = startTime + slotDuration;
-    printf("You have chosen time slot %d (%02d:00 - %02d:00) for %s.\n", 
-           chosenSlot, startTime, endTime, sportName(chosenSport));
-    
-    return 1;
-}
-
-const char* sportName(int sport) {
-    switch (sport) {
-        case 1: return "Tennis";
-        case 2: return "Basketball";
-        case 3: return "Swimming";
-        case 4: return "Football";
-        case 5: return "Badminton";
-        case 6: return "Table Tennis";
-        default: return "Unknown";
-    }
-}
-
-struct Customer* createCustomer(char name[], char email[], char phoneNumber[], char address[], int age) {
-    struct Customer* newCustomer = (struct Customer*)malloc(sizeof(struct Customer));
-    if (newCustomer != NULL) {
-        strcpy(newCustomer->name, name);
-        strcpy(newCustomer->email, email);
-        strcpy(newCustomer->phoneNumber, phoneNumber);
-        strcpy(newCustomer->address, address);
-        newCustomer->age = age;
-        newCustomer->next = NULL;
-    }
-    return newCustomer;
-}
-
-struct Booking* createBooking(int customerId, int sport, int timeSlot) {
-    static int lastBookingId = 0;
-    struct Booking* newBooking = (struct Booking*)malloc(sizeof(struct Booking));
-    if (newBooking != NULL) {
-        newBooking->bookingId = ++lastBookingId;
-        newBooking->customerId = customerId;
-        newBooking->sport = sport;
-        newBooking->timeSlot = timeSlot;
-        newBooking->next = NULL;
-    }
-    return newBooking;
-}
-
-void addCustomer(struct Customer** head, struct Customer* newCustomer) {
-    if (*head == NULL) {
-        *head = newCustomer;
-    } else {
-        struct Customer* current = *head;
-        while (current->next != NULL) {
-            current = current->next;
-        }
-        current->next = newCustomer;
-    }
-}
-
-void addBooking(struct Booking** head, struct Booking* newBooking) {
-    if (*head == NULL) {
-        *head = newBooking;
-    } else {
-        struct Booking* current = *head;
-        while (current->next != NULL) {
-            current = current->next;
-        }
-        current->next = newBooking;
-    }
-}
 
-// Helper function for case-insensitive string comparison
-int stringCompareIgnoreCase(const char* str1, const char* str2) {
-    while (*str1 && *str2) {
-        char c1 = tolower(*str1);
-        char c2 = tolower(*str2);
-        if (c1 != c2) {
-            return c1 - c2;
-        }
-        str1++;
-        str2++;
-    }
-    return tolower(*str1) - tolower(*str2);
-}
-
-struct Customer* findCustomerByName(struct Customer* head, const char* name) {
-    struct Customer* current = head;
-    while (current != NULL) {
-        if (stringCompareIgnoreCase(current->name, name) == 0) {
-            return current;
-        }
-        current = current->next;
-    }
-    return NULL;
-}
+    printf("You have chosen time slot %d (%02d:00 - %02d:00) for %s on %s.\n",
+           chosenSlot, slotStartHour(chosenSlot), slotEndHour(chosenSlot), sportName(chosenSport), date);
 
-struct Customer* findCustomerById(struct Customer* head, int id) {
-    struct Customer* current = head;
-    while (current != NULL) {
-        if (current->customerId == id) {
-            return current;
-        }
-        current = current->next;
-    }
-    return NULL;
-}
-
-bool hasBookingInSport(struct Booking* bookingHead, int customerId, int sport) {
-    struct Booking* current = bookingHead;
-    while (current != NULL) {
-        if (current->customerId == customerId && current->sport == sport) {
-            return true;
-        }
-        current = current->next;
-    }
-    return false;
-}
-
-bool isValidEmail(const char *email) {
-    return strchr(email, '@') != NULL && strchr(email, '.') != NULL;
-}
-
-bool isValidPhoneNumber(const char *phoneNumber) {
-    int digitCount = 0;
-    while (*phoneNumber) {
-        if (isdigit(*phoneNumber)) {
-            digitCount++;
-        }
-        phoneNumber++;
-    }
-    return digitCount == 10;
-}
-
-bool isValidAddress(const char *address) {
-    bool hasLetter = false;
-    bool hasDigit = false;
-    while (*address) {
-        if (isalpha(*address)) {
-            hasLetter = true;
-        } else if (isdigit(*address)) {
-            hasDigit = true;
-        }
-        address++;
-    }
-    return hasLetter && hasDigit;
+    return 1;
 }
 
-void registerCustomer(struct Customer **customerHead, unsigned int *lastCustomerId) {
-    char name[50];
-    char email[50];
-    char phoneNumber[15];
-    char address[100];
+void registerCustomer(struct SportsCentre* centre) {
+    char name[SCMS_NAME_LEN];
+    char email[SCMS_EMAIL_LEN];
+    char phoneNumber[SCMS_PHONE_LEN];
+    char address[SCMS_ADDRESS_LEN];
     int age;
 
     printf("Enter Customer Name: ");
-    scanf(" %[^\n]", name);
+    scanf(" %49[^\n]", name);
 
     // Check if customer already exists
-    if (findCustomerByName(*customerHead, name) != NULL) {
+    if (findCustomerByName(centre->customerHead, name) != NULL) {
         printf("Customer with name '%s' already exists! Use 'Book Slot' option to book slots for existing customers.\n", name);
         return;
     }
@@ -290,7 +130,7 @@ void registerCustomer(struct Customer **customerHead, unsigned int *lastCustomer
     // Email validation loop
     do {
         printf("Enter Customer Email: ");
-        scanf(" %[^\n]", email);
+        scanf(" %49[^\n]", email);
         if (!isValidEmail(email)) {
             printf("Invalid email format. Please enter a valid email.\n");
         }
@@ -299,7 +139,7 @@ void registerCustomer(struct Customer **customerHead, unsigned int *lastCustomer
     // Phone number validation loop
     do {
         printf("Enter Customer Phone Number (10 digits): ");
-        scanf(" %[^\n]", phoneNumber);
+        scanf(" %14[^\n]", phoneNumber);
         if (!isValidPhoneNumber(phoneNumber)) {
             printf("Invalid phone number format. Please enter a 10-digit phone number.\n");
         }
@@ -308,7 +148,7 @@ void registerCustomer(struct Customer **customerHead, unsigned int *lastCustomer
     // Address validation loop
     do {
         printf("Enter Customer Address (should contain both letters and numbers): ");
-        scanf(" %[^\n]", address);
+        scanf(" %99[^\n]", address);
         if (!isValidAddress(address)) {
             printf("Invalid address format. Please enter an address containing both letters and numbers.\n");
         }
@@ -317,26 +157,26 @@ void registerCustomer(struct Customer **customerHead, unsigned int *lastCustomer
     printf("Enter Customer Age: ");
     scanf("%d", &age);
 
-    struct Customer *newCustomer = createCustomer(name, email, phoneNumber, address, age);
-    if (newCustomer != NULL) {
-        newCustomer->customerId = ++(*lastCustomerId);
-        addCustomer(customerHead, newCustomer);
+    struct Customer* newCustomer = NULL;
+    ScmsStatus status = scmsRegisterCustomer(centre, name, email, phoneNumber, address, age, &newCustomer);
+    if (status == SCMS_OK) {
         printf("Customer '%s' registered successfully!\n", name);
-        printf("Customer ID: %u\n", newCustomer->customerId);
+        printf("Customer ID: %d\n", newCustomer->customerId);
         printf("Now you can book slots for this customer using the 'Book Slot' option.\n");
     } else {
-        printf("Memory allocation error.\n");
+        printf("%s.\n", scmsStatusMessage(status));
     }
 }
 
-void bookSlot(struct Customer* customerHead, struct Booking** bookingHead, unsigned int *lastCustomerId) {
-    char name[50];
-    int selectedSport, selectedTimeSlot;
+void bookSlot(struct SportsCentre* centre) {
+    char name[SCMS_NAME_LEN];
+    char date[16];
+    int dayOffset, selectedSport, selectedTimeSlot;
 
     printf("Enter Customer Name: ");
-    scanf(" %[^\n]", name);
+    scanf(" %49[^\n]", name);
 
-    struct Customer* customer = findCustomerByName(customerHead, name);
+    struct Customer* customer = findCustomerByName(centre->customerHead, name);
     if (customer == NULL) {
         printf("Customer '%s' not found! Please register the customer first using 'Add Customer' option.\n", name);
         return;
@@ -344,117 +184,101 @@ void bookSlot(struct Customer* customerHead, struct Booking** bookingHead, unsig
 
     printf("Customer found: %s (ID: %d)\n", customer->name, customer->customerId);
 
+    printf("Enter booking day (0 = today, 1 = tomorrow, up to %d): ", SCMS_BOOKING_HORIZON_DAYS - 1);
+    scanf("%d", &dayOffset);
+    int day = scmsCurrentDay(centre) + dayOffset;
+
     // Check available slots and let user select
-    if (listAvailableSports(*bookingHead, &selectedSport, &selectedTimeSlot)) {
-        // Check if customer already has a booking in this sport
-        if (hasBookingInSport(*bookingHead, customer->customerId, selectedSport)) {
-            printf("Error: Customer '%s' already has a booking in %s. Each customer can book only one slot per sport.\n", 
-                   customer->name, sportName(selectedSport));
-            return;
-        }
+    if (!listAvailableSports(centre, day, &selectedSport, &selectedTimeSlot)) {
+        printf("Booking failed. Please try again with an available slot.\n");
+        return;
+    }
 
-        struct Booking* newBooking = createBooking(customer->customerId, selectedSport, selectedTimeSlot);
-        if (newBooking != NULL) {
-            addBooking(bookingHead, newBooking);
-            
-            int startTime = 8 + (selectedTimeSlot - 1) * 2;
-            int endTime = startTime + 2;
+    struct Booking* newBooking = NULL;
+    ScmsStatus status = scmsBookSlot(centre, customer->customerId, day, selectedSport, selectedTimeSlot, &newBooking);
+    switch (status) {
+        case SCMS_OK:
             printf("Slot booked successfully for customer '%s'!\n", customer->name);
             printf("Booking ID: %d\n", newBooking->bookingId);
             printf("Sport: %s\n", sportName(selectedSport));
-            printf("Time Slot: %02d:00 - %02d:00\n", startTime, endTime);
-        } else {
-            printf("Memory allocation error.\n");
-        }
-    } else {
-        printf("Booking failed. Please try again with an available slot.\n");
+            printf("Date: %s\n", formatDay(day, date, sizeof(date)));
+            printf("Time Slot: %02d:00 - %02d:00\n", slotStartHour(selectedTimeSlot), slotEndHour(selectedTimeSlot));
+            break;
+        case SCMS_ERR_DUPLICATE_SPORT:
+            printf("Error: Customer '%s' already has a booking in %s on that day. Each customer can book only one slot per sport per day.\n",
+                   customer->name, sportName(selectedSport));
+            break;
+        default:
+            printf("%s. Booking failed.\n", scmsStatusMessage(status));
+            break;
     }
 }
 
-void displayBookedSlots(struct Booking* bookingHead, struct Customer* customerHead) {
-    if (bookingHead == NULL) {
+void displayBookedSlots(const struct SportsCentre* centre) {
+    if (centre->bookingHead == NULL) {
         printf("No slots have been booked.\n");
         return;
     }
 
     printf("Booked Slots:\n");
 
-    int slotsCount[6][6] = {0}; // [sport][timeSlot]
-
-    struct Booking* current = bookingHead;
-    while (current != NULL) {
-        if (current->sport >= 1 && current->sport <= 6 && 
-            current->timeSlot >= 1 && current->timeSlot <= 6) {
-            slotsCount[current->sport - 1][current->timeSlot - 1]++;
-        }
-        current = current->next;
-    }
-
-    for (int i = 0; i < 6; i++) {
-        bool sportHasBookings = false;
-        for (int j = 0; j < 6; j++) {
-            if (slotsCount[i][j] > 0) {
-                sportHasBookings = true;
-                break;
+    int today = scmsCurrentDay(centre);
+    for (int day = today; day < today + SCMS_BOOKING_HORIZON_DAYS; day++) {
+        struct SlotAvailability availability;
+        scmsGetAvailability(centre, day, &availability);
+
+        bool dayPrinted = false;
+        for (int i = 0; i < SCMS_SPORT_COUNT; i++) {
+            bool sportHasBookings = false;
+            for (int j = 0; j < SCMS_SLOTS_PER_SPORT; j++) {
+                if (availability.open[j] && availability.booked[i][j] > 0) {
+                    sportHasBookings = true;
+                    break;
+                }
             }
-        }
-        
-        if (sportHasBookings) {
-            printf("%s:\n", sportName(i + 1));
-            for (int j = 0; j < 6; j++) {
-                if (slotsCount[i][j] > 0) {
-                    int startTime = 8 + j * 2;
-                    int endTime = startTime + 2;
-                    printf("  Time Slot %02d:00 - %02d:00: %d booking(s)\n", 
-                           startTime, endTime, slotsCount[i][j]);
+
+            if (sportHasBookings) {
+                if (!dayPrinted) {
+                    char date[16];
+                    printf("%s:\n", formatDay(day, date, sizeof(date)));
+                    dayPrinted = true;
+                }
+                printf(" %s:\n", sportName(i + 1));
+                for (int j = 0; j < SCMS_SLOTS_PER_SPORT; j++) {
+                    if (availability.open[j] && availability.booked[i][j] > 0) {
+                        printf("  Time Slot %02d:00 - %02d:00: %d booking(s)\n",
+                               slotStartHour(j + 1), slotEndHour(j + 1), availability.booked[i][j]);
+                    }
                 }
             }
         }
     }
 }
 
-void freeCustomers(struct Customer* head) {
-    struct Customer* current = head;
-    while (current != NULL) {
-        struct Customer* next = current->next;
-        free(current);
-        current = next;
-    }
-}
-
-void freeBookings(struct Booking* head) {
-    struct Booking* current = head;
-    while (current != NULL) {
-        struct Booking* next = current->next;
-        free(current);
-        current = next;
-    }
-}
-
-void listCustomerInfo(struct Customer* head) {
-    if (head == NULL) {
+void listCustomerInfo(const struct SportsCentre* centre) {
+    if (centre->customerHead == NULL) {
         printf("No customers are registered.\n");
         return;
     }
 
     printf("Registered Customers:\n");
-    struct Customer* current = head;
+    struct Customer* current = centre->customerHead;
     while (current != NULL) {
-        printf("ID: %d, Name: %s, Age: %d, Email: %s, Phone: %s\n", 
+        printf("ID: %d, Name: %s, Age: %d, Email: %s, Phone: %s\n",
                current->customerId, current->name, current->age, current->email, current->phoneNumber);
         current = current->next;
     }
     printf("\n");
 }
 
-void searchCustomer(struct Customer* customerHead, struct Booking* bookingHead) {
-    if (customerHead == NULL) {
+void searchCustomer(const struct SportsCentre* centre) {
+    if (centre->customerHead == NULL) {
         printf("No customers are registered.\n");
         return;
     }
 
     int searchId;
-    char searchName[50];
+    char searchName[SCMS_NAME_LEN];
     int searchBy;
 
     printf("Search by:\n");
@@ -467,8 +291,8 @@ void searchCustomer(struct Customer* customerHead, struct Booking* bookingHead)
 
     if (searchBy == 1) {
         printf("Enter Customer Name to Search: ");
-        scanf(" %[^\n]", searchName);
-        customer = findCustomerByName(customerHead, searchName);
+        scanf(" %49[^\n]", searchName);
+        customer = findCustomerByName(centre->customerHead, searchName);
         if (customer == NULL) {
             printf("Customer with name '%s' not found.\n", searchName);
             return;
@@ -476,7 +300,7 @@ void searchCustomer(struct Customer* customerHead, struct Booking* bookingHead)
     } else if (searchBy == 2) {
         printf("Enter Customer ID to Search: ");
         scanf("%d", &searchId);
-        customer = findCustomerById(customerHead, searchId);
+        customer = findCustomerById(centre->customerHead, searchId);
         if (customer == NULL) {
             printf("Customer with ID %d not found.\n", searchId);
             return;
@@ -487,23 +311,23 @@ void searchCustomer(struct Customer* customerHead, struct Booking* bookingHead)
     }
 
     printf("Customer Found:\n");
-    printf("ID: %u\n", customer->customerId);
+    printf("ID: %d\n", customer->customerId);
     printf("Name: %s\n", customer->name);
     printf("Age: %d\n", customer->age);
     printf("Email: %s\n", customer->email);
     printf("Phone: %s\n", customer->phoneNumber);
     printf("Address: %s\n", customer->address);
-    
+
     // Show customer's bookings
     printf("Bookings:\n");
-    struct Booking* booking = bookingHead;
+    struct Booking* booking = centre->bookingHead;
     bool hasBookings = false;
     while (booking != NULL) {
         if (booking->customerId == customer->customerId) {
-            int startTime = 8 + (booking->timeSlot - 1) * 2;
-            int endTime = startTime + 2;
-            printf("  - %s: %02d:00 - %02d:00 (Booking ID: %d)\n", 
-                   sportName(booking->sport), startTime, endTime, booking->bookingId);
+            char date[16];
+            printf("  - %s on %s: %02d:00 - %02d:00 (Booking ID: %d)\n",
+                   sportName(booking->sport), formatDay(booking->day, date, sizeof(date)),
+                   slotStartHour(booking->timeSlot), slotEndHour(booking->timeSlot), booking->bookingId);
             hasBookings = true;
         }
         booking = booking->next;
@@ -513,86 +337,45 @@ void searchCustomer(struct Customer* customerHead, struct Booking* bookingHead)
     }
 }
 
-void deleteCustomer(struct Customer** customerHead, struct Booking** bookingHead, const char* deleteName) {
-    if (*customerHead == NULL) {
+void deleteCustomer(struct SportsCentre* centre, const char* deleteName) {
+    if (centre->customerHead == NULL) {
         printf("No customers are registered.\n");
         return;
     }
 
-    struct Customer* customer = findCustomerByName(*customerHead, deleteName);
-    if (customer == NULL) {
+    int deletedBookings = 0;
+    if (scmsDeleteCustomer(centre, deleteName, &deletedBookings) != SCMS_OK) {
         printf("Customer with name '%s' not found.\n", deleteName);
         return;
     }
 
-    int customerId = customer->customerId;
-
-    // Delete all bookings for this customer
-    struct Booking* bookingCurrent = *bookingHead;
-    struct Booking* bookingPrev = NULL;
-    int deletedBookings = 0;
-
-    while (bookingCurrent != NULL) {
-        if (bookingCurrent->customerId == customerId) {
-            if (bookingPrev == NULL) {
-                *bookingHead = bookingCurrent->next;
-            } else {
-                bookingPrev->next = bookingCurrent->next;
-            }
-            struct Booking* toDelete = bookingCurrent;
-            bookingCurrent = bookingCurrent->next;
-            free(toDelete);
-            deletedBookings++;
-        } else {
-            bookingPrev = bookingCurrent;
-            bookingCurrent = bookingCurrent->next;
-        }
-    }
-
-    // Delete the customer
-    struct Customer* current = *customerHead;
-    struct Customer* prev = NULL;
-
-    while (current != NULL) {
-        if (stringCompareIgnoreCase(current->name, deleteName) == 0) {
-            if (prev == NULL) {
-                *customerHead = current->next;
-            } else {
-                prev->next = current->next;
-            }
-            free(current);
-            printf("Customer '%s' and all their %d booking(s) have been permanently deleted.\n", 
-                   deleteName, deletedBookings);
-            return;
-        }
-        prev = current;
-        current = current->next;
-    }
+    printf("Customer '%s' and all their %d booking(s) have been permanently deleted.\n",
+           deleteName, deletedBookings);
 }
 
-void cancelBooking(struct Booking** bookingHead, struct Customer* customerHead, const char* cancelName) {
-    if (*bookingHead == NULL) {
+void cancelBooking(struct SportsCentre* centre, const char* cancelName) {
+    if (centre->bookingHead == NULL) {
         printf("No bookings found.\n");
         return;
     }
 
-    struct Customer* customer = findCustomerByName(customerHead, cancelName);
+    struct Customer* customer = findCustomerByName(centre->customerHead, cancelName);
     if (customer == NULL) {
         printf("Customer with name '%s' not found.\n", cancelName);
         return;
     }
 
     // Find and display customer's bookings
-    struct Booking* booking = *bookingHead;
+    struct Booking* booking = centre->bookingHead;
     int bookingCount = 0;
     printf("Bookings for customer '%s':\n", cancelName);
-    
+
     while (booking != NULL) {
         if (booking->customerId == customer->customerId) {
-            int startTime = 8 + (booking->timeSlot - 1) * 2;
-            int endTime = startTime + 2;
-            printf("%d. %s: %02d:00 - %02d:00 (Booking ID: %d)\n", 
-                   ++bookingCount, sportName(booking->sport), startTime, endTime, booking->bookingId);
+            char date[16];
+            printf("%d. %s on %s: %02d:00 - %02d:00 (Booking ID: %d)\n",
+                   ++bookingCount, sportName(booking->sport), formatDay(booking->day, date, sizeof(date)),
+                   slotStartHour(booking->timeSlot), slotEndHour(booking->timeSlot), booking->bookingId);
         }
         booking = booking->next;
     }
@@ -607,38 +390,44 @@ void cancelBooking(struct Booking** bookingHead, struct Customer* customerHead,
     scanf("%d", &bookingIdToCancel);
 
     // Cancel the specific booking
-    struct Booking* current = *bookingHead;
-    struct Booking* prev = NULL;
+    struct Booking cancelled;
+    if (scmsCancelBooking(centre, customer->customerId, bookingIdToCancel, &cancelled) != SCMS_OK) {
+        printf("Booking ID %d not found for customer '%s'.\n", bookingIdToCancel, cancelName);
+        return;
+    }
 
-    while (current != NULL) {
-        if (current->bookingId == bookingIdToCancel && current->customerId == customer->customerId) {
-            int startTime = 8 + (current->timeSlot - 1) * 2;
-            int endTime = startTime + 2;
-            
-            printf("Booking canceled: %s (%02d:00 - %02d:00) for customer '%s'.\n", 
-                   sportName(current->sport), startTime, endTime, cancelName);
-            printf("Customer details remain in the system.\n");
-
-            if (prev == NULL) {
-                *bookingHead = current->next;
-            } else {
-                prev->next = current->next;
-            }
-            free(current);
-            return;
-        }
-        prev = current;
-        current = current->next;
+    char date[16];
+    printf("Booking canceled: %s on %s (%02d:00 - %02d:00) for customer '%s'.\n",
+           sportName(cancelled.sport), formatDay(cancelled.day, date, sizeof(date)),
+           slotStartHour(cancelled.timeSlot), slotEndHour(cancelled.timeSlot), cancelName);
+    printf("Customer details remain in the system.\n");
+}
+
+void displayBookingHistory(const struct SportsCentre* centre) {
+    const struct BookingArchive* archive = &centre->archive;
+    if (archive->count == 0) {
+        printf("No completed bookings yet.\n");
+        return;
     }
 
-    printf("Booking ID %d not found for customer '%s'.\n", bookingIdToCancel, cancelName);
+    printf("Completed Bookings:\n");
+    for (size_t i = 0; i < archive->count; i++) {
+        const struct BookingRecord* record = &archive->records[i];
+        struct Customer* customer = findCustomerById(centre->customerHead, record->customerId);
+        char date[16];
+        printf("  Booking ID %d: %s on %s, %02d:00 - %02d:00, Customer: %s\n",
+               record->bookingId, sportName(record->sport), formatDay(record->day, date, sizeof(date)),
+               slotStartHour(record->timeSlot), slotEndHour(record->timeSlot),
+               customer != NULL ? customer->name : "(deleted)");
+    }
 }
 
 int main() {
-    struct Customer* customerList = NULL;
-    struct Booking* bookingList = NULL;
+    struct SportsCentre centre;
     int choice;
 
+    scmsInit(&centre);
+
     while (1) {
         printf("\nSports Center Management System\n");
         printf("1. Add Customer (Register new customer)\n");
@@ -648,45 +437,53 @@ int main() {
         printf("5. Book Slot (For existing customers)\n");
         printf("6. Cancel Booking (Cancel specific booking only)\n");
         printf("7. Display Booked Slots\n");
-        printf("8. Exit\n");
+        printf("8. Booking History (Completed bookings)\n");
+        printf("9. Exit\n");
         printf("Enter your choice: ");
-        scanf("%d", &choice);
+        if (scanf("%d", &choice) != 1) {
+            choice = 9;
+        }
+
+        // Retire bookings whose slots finished while waiting for input
+        scmsAdvanceClock(&centre, currentCentreTime(), NULL);
 
         switch (choice) {
             case 1:
-                registerCustomer(&customerList, &lastCustomerId);
+                registerCustomer(&centre);
                 break;
             case 2:
-                listCustomerInfo(customerList);
+                listCustomerInfo(&centre);
                 break;
             case 3:
-                searchCustomer(customerList, bookingList);
+                searchCustomer(&centre);
                 break;
             case 4:
                 {
-                    char deleteName[50];
+                    char deleteName[SCMS_NAME_LEN];
                     printf("Enter Customer Name to Delete: ");
-                    scanf(" %[^\n]", deleteName);
-                    deleteCustomer(&customerList, &bookingList, deleteName);
+                    scanf(" %49[^\n]", deleteName);
+                    deleteCustomer(&centre, deleteName);
                     break;
                 }
             case 5:
-                bookSlot(customerList, &bookingList, &lastCustomerId);
+                bookSlot(&centre);
                 break;
             case 6:
                 {
-                    char cancelName[50];
+                    char cancelName[SCMS_NAME_LEN];
                     printf("Enter Customer Name to Cancel Booking: ");
-                    scanf(" %[^\n]", cancelName);
-                    cancelBooking(&bookingList, customerList, cancelName);
+                    scanf(" %49[^\n]", cancelName);
+                    cancelBooking(&centre, cancelName);
                     break;
                 }
             case 7:
-                displayBookedSlots(bookingList, customerList);
+                displayBookedSlots(&centre);
                 break;
             case 8:
-                freeCustomers(customerList);
-                freeBookings(bookingList);
+                displayBookingHistory(&centre);
+                break;
+            case 9:
+                scmsFree(&centre);
                 printf("Thank you for using Sports Center Management System!\n");
                 exit(0);
             default:
@@ -695,4 +492,4 @@ int main() {
     }
 
     return 0;
-}
\ No newline at end of file
+}
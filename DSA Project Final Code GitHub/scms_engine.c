@@ -0,0 +1,529 @@
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "scms_engine.h"
+
+// Bounded copy that always NUL-terminates the destination
+static void copyString(char* dest, const char* src, size_t size) {
+    strncpy(dest, src, size - 1);
+    dest[size - 1] = '\0';
+}
+
+static bool isValidSport(int sport) {
+    return sport >= 1 && sport <= SCMS_SPORT_COUNT;
+}
+
+static bool isValidTimeSlot(int timeSlot) {
+    return timeSlot >= 1 && timeSlot <= SCMS_SLOTS_PER_SPORT;
+}
+
+static bool isBookableDay(const struct SportsCentre* centre, int day) {
+    int today = scmsCurrentDay(centre);
+    return day >= today && day < today + SCMS_BOOKING_HORIZON_DAYS;
+}
+
+static bool hasSlotStarted(const struct SportsCentre* centre, int day, int timeSlot) {
+    return day == scmsCurrentDay(centre) && slotStartHour(timeSlot) <= centre->now % SCMS_HOURS_PER_DAY;
+}
+
+static int* slotCount(struct SportsCentre* centre, const struct Booking* booking) {
+    return &centre->slotCounts[booking->day % SCMS_BOOKING_HORIZON_DAYS][booking->sport - 1][booking->timeSlot - 1];
+}
+
+static struct Customer* createCustomer(const char* name, const char* email, const char* phoneNumber,
+                                       const char* address, int age) {
+    struct Customer* newCustomer = (struct Customer*)malloc(sizeof(struct Customer));
+    if (newCustomer != NULL) {
+        copyString(newCustomer->name, name, sizeof(newCustomer->name));
+        copyString(newCustomer->email, email, sizeof(newCustomer->email));
+        copyString(newCustomer->phoneNumber, phoneNumber, sizeof(newCustomer->phoneNumber));
+        copyString(newCustomer->address, address, sizeof(newCustomer->address));
+        newCustomer->age = age;
+        newCustomer->next = NULL;
+    }
+    return newCustomer;
+}
+
+static struct Booking* createBooking(int bookingId, int customerId, int day, int sport, int timeSlot) {
+    struct Booking* newBooking = (struct Booking*)malloc(sizeof(struct Booking));
+    if (newBooking != NULL) {
+        newBooking->bookingId = bookingId;
+        newBooking->customerId = customerId;
+        newBooking->day = day;
+        newBooking->sport = sport;
+        newBooking->timeSlot = timeSlot;
+        newBooking->prev = NULL;
+        newBooking->next = NULL;
+        newBooking->timerPrev = NULL;
+        newBooking->timerNext = NULL;
+    }
+    return newBooking;
+}
+
+static void addCustomer(struct SportsCentre* centre, struct Customer* newCustomer) {
+    if (centre->customerTail == NULL) {
+        centre->customerHead = newCustomer;
+    } else {
+        centre->customerTail->next = newCustomer;
+    }
+    centre->customerTail = newCustomer;
+}
+
+// Expiry wheel bucket for a booking: today's bookings sit in the hour wheel
+// under their end hour, later ones in the day wheel until their day arrives.
+static struct Booking** timerBucket(struct SportsCentre* centre, const struct Booking* booking) {
+    if (booking->day == scmsCurrentDay(centre)) {
+        return &centre->hourWheel[slotEndHour(booking->timeSlot)];
+    }
+    return &centre->dayWheel[booking->day % SCMS_BOOKING_HORIZON_DAYS];
+}
+
+static void scheduleBooking(struct SportsCentre* centre, struct Booking* booking) {
+    struct Booking** bucket = timerBucket(centre, booking);
+    booking->timerPrev = NULL;
+    booking->timerNext = *bucket;
+    if (*bucket != NULL) {
+        (*bucket)->timerPrev = booking;
+    }
+    *bucket = booking;
+}
+
+static void unscheduleBooking(struct SportsCentre* centre, struct Booking* booking) {
+    if (booking->timerPrev == NULL) {
+        *timerBucket(centre, booking) = booking->timerNext;
+    } else {
+        booking->timerPrev->timerNext = booking->timerNext;
+    }
+    if (booking->timerNext != NULL) {
+        booking->timerNext->timerPrev = booking->timerPrev;
+    }
+}
+
+static void addBooking(struct SportsCentre* centre, struct Booking* newBooking) {
+    newBooking->prev = centre->bookingTail;
+    if (centre->bookingTail == NULL) {
+        centre->bookingHead = newBooking;
+    } else {
+        centre->bookingTail->next = newBooking;
+    }
+    centre->bookingTail = newBooking;
+    centre->liveBookings++;
+    (*slotCount(centre, newBooking))++;
+    scheduleBooking(centre, newBooking);
+}
+
+// Unlinks a booking from the live list; the caller still owns the node
+static void unlinkBooking(struct SportsCentre* centre, struct Booking* booking) {
+    if (booking->prev == NULL) {
+        centre->bookingHead = booking->next;
+    } else {
+        booking->prev->next = booking->next;
+    }
+    if (booking->next == NULL) {
+        centre->bookingTail = booking->prev;
+    } else {
+        booking->next->prev = booking->prev;
+    }
+    centre->liveBookings--;
+}
+
+// Cancels a live booking, giving its place back to the slot
+static void removeBooking(struct SportsCentre* centre, struct Booking* booking) {
+    unscheduleBooking(centre, booking);
+    unlinkBooking(centre, booking);
+    (*slotCount(centre, booking))--;
+    free(booking);
+}
+
+static bool archiveBooking(struct BookingArchive* archive, const struct Booking* booking) {
+    if (archive->count == archive->capacity) {
+        size_t newCapacity = archive->capacity == 0 ? 64 : archive->capacity * 2;
+        struct BookingRecord* records = (struct BookingRecord*)realloc(archive->records,
+                                                                       newCapacity * sizeof(struct BookingRecord));
+        if (records == NULL) {
+            return false;
+        }
+        archive->records = records;
+        archive->capacity = newCapacity;
+    }
+
+    struct BookingRecord* record = &archive->records[archive->count++];
+    record->bookingId = booking->bookingId;
+    record->customerId = booking->customerId;
+    record->day = booking->day;
+    record->sport = (unsigned char)booking->sport;
+    record->timeSlot = (unsigned char)booking->timeSlot;
+    return true;
+}
+
+// Retires every booking in the bucket. The slot counters are left alone:
+// a played slot stays used until its day's row is cleared at rollover.
+static int retireBucket(struct SportsCentre* centre, struct Booking** bucket, bool* archiveFailed) {
+    int retired = 0;
+    struct Booking* current = *bucket;
+    *bucket = NULL;
+    while (current != NULL) {
+        struct Booking* next = current->timerNext;
+        unlinkBooking(centre, current);
+        if (!archiveBooking(&centre->archive, current)) {
+            *archiveFailed = true;
+        }
+        free(current);
+        retired++;
+        current = next;
+    }
+    return retired;
+}
+
+// Called once the clock reaches hour 0 of a new day
+static void rollOverDay(struct SportsCentre* centre) {
+    int today = scmsCurrentDay(centre);
+
+    // Yesterday's row becomes the row for the last day of the booking horizon
+    memset(centre->slotCounts[(today - 1) % SCMS_BOOKING_HORIZON_DAYS], 0,
+           sizeof(centre->slotCounts[0]));
+
+    // Cascade today's bookings from the day wheel into the hour wheel
+    struct Booking** dayBucket = &centre->dayWheel[today % SCMS_BOOKING_HORIZON_DAYS];
+    struct Booking* current = *dayBucket;
+    *dayBucket = NULL;
+    while (current != NULL) {
+        struct Booking* next = current->timerNext;
+        scheduleBooking(centre, current);
+        current = next;
+    }
+}
+
+void scmsInit(struct SportsCentre* centre) {
+    memset(centre, 0, sizeof(*centre));
+}
+
+void scmsFree(struct SportsCentre* centre) {
+    struct Customer* customer = centre->customerHead;
+    while (customer != NULL) {
+        struct Customer* next = customer->next;
+        free(customer);
+        customer = next;
+    }
+
+    struct Booking* booking = centre->bookingHead;
+    while (booking != NULL) {
+        struct Booking* next = booking->next;
+        free(booking);
+        booking = next;
+    }
+
+    free(centre->archive.records);
+    scmsInit(centre);
+}
+
+ScmsStatus scmsRegisterCustomer(struct SportsCentre* centre, const char* name, const char* email,
+                                const char* phoneNumber, const char* address, int age,
+                                struct Customer** registered) {
+    if (name == NULL || email == NULL || phoneNumber == NULL || address == NULL || name[0] == '\0') {
+        return SCMS_ERR_INVALID_ARGUMENT;
+    }
+    if (findCustomerByName(centre->customerHead, name) != NULL) {
+        return SCMS_ERR_CUSTOMER_EXISTS;
+    }
+    if (!isValidEmail(email)) {
+        return SCMS_ERR_INVALID_EMAIL;
+    }
+    if (!isValidPhoneNumber(phoneNumber)) {
+        return SCMS_ERR_INVALID_PHONE;
+    }
+    if (!isValidAddress(address)) {
+        return SCMS_ERR_INVALID_ADDRESS;
+    }
+
+    struct Customer* newCustomer = createCustomer(name, email, phoneNumber, address, age);
+    if (newCustomer == NULL) {
+        return SCMS_ERR_NO_MEMORY;
+    }
+    newCustomer->customerId = ++centre->lastCustomerId;
+    addCustomer(centre, newCustomer);
+
+    if (registered != NULL) {
+        *registered = newCustomer;
+    }
+    return SCMS_OK;
+}
+
+ScmsStatus scmsDeleteCustomer(struct SportsCentre* centre, const char* name, int* deletedBookings) {
+    struct Customer* current = centre->customerHead;
+    struct Customer* prev = NULL;
+    while (current != NULL && stringCompareIgnoreCase(current->name, name) != 0) {
+        prev = current;
+        current = current->next;
+    }
+    if (current == NULL) {
+        return SCMS_ERR_CUSTOMER_NOT_FOUND;
+    }
+
+    // Delete all bookings for this customer
+    int deleted = 0;
+    struct Booking* bookingCurrent = centre->bookingHead;
+    while (bookingCurrent != NULL) {
+        struct Booking* next = bookingCurrent->next;
+        if (bookingCurrent->customerId == current->customerId) {
+            removeBooking(centre, bookingCurrent);
+            deleted++;
+        }
+        bookingCurrent = next;
+    }
+
+    // Delete the customer
+    if (prev == NULL) {
+        centre->customerHead = current->next;
+    } else {
+        prev->next = current->next;
+    }
+    if (centre->customerTail == current) {
+        centre->customerTail = prev;
+    }
+    free(current);
+
+    if (deletedBookings != NULL) {
+        *deletedBookings = deleted;
+    }
+    return SCMS_OK;
+}
+
+ScmsStatus scmsBookSlot(struct SportsCentre* centre, int customerId, int day, int sport, int timeSlot,
+                        struct Booking** booked) {
+    if (!isBookableDay(centre, day)) {
+        return SCMS_ERR_INVALID_DAY;
+    }
+    if (!isValidSport(sport)) {
+        return SCMS_ERR_INVALID_SPORT;
+    }
+    if (!isValidTimeSlot(timeSlot)) {
+        return SCMS_ERR_INVALID_SLOT;
+    }
+    if (hasSlotStarted(centre, day, timeSlot)) {
+        return SCMS_ERR_SLOT_PASSED;
+    }
+    if (findCustomerById(centre->customerHead, customerId) == NULL) {
+        return SCMS_ERR_CUSTOMER_NOT_FOUND;
+    }
+    if (centre->slotCounts[day % SCMS_BOOKING_HORIZON_DAYS][sport - 1][timeSlot - 1] >= SCMS_MAX_CUSTOMERS_PER_SLOT) {
+        return SCMS_ERR_SLOT_FULL;
+    }
+    // Each customer can book only one slot per sport per day
+    if (hasBookingInSport(centre->bookingHead, customerId, day, sport)) {
+        return SCMS_ERR_DUPLICATE_SPORT;
+    }
+
+    struct Booking* newBooking = createBooking(centre->lastBookingId + 1, customerId, day, sport, timeSlot);
+    if (newBooking == NULL) {
+        return SCMS_ERR_NO_MEMORY;
+    }
+    centre->lastBookingId++;
+    addBooking(centre, newBooking);
+
+    if (booked != NULL) {
+        *booked = newBooking;
+    }
+    return SCMS_OK;
+}
+
+ScmsStatus scmsCancelBooking(struct SportsCentre* centre, int customerId, int bookingId,
+                             struct Booking* cancelled) {
+    struct Booking* current = centre->bookingHead;
+
+    while (current != NULL) {
+        if (current->bookingId == bookingId && current->customerId == customerId) {
+            if (cancelled != NULL) {
+                *cancelled = *current;
+                cancelled->prev = NULL;
+                cancelled->next = NULL;
+                cancelled->timerPrev = NULL;
+                cancelled->timerNext = NULL;
+            }
+            removeBooking(centre, current);
+            return SCMS_OK;
+        }
+        current = current->next;
+    }
+    return SCMS_ERR_BOOKING_NOT_FOUND;
+}
+
+ScmsStatus scmsGetAvailability(const struct SportsCentre* centre, int day, struct SlotAvailability* out) {
+    if (!isBookableDay(centre, day)) {
+        return SCMS_ERR_INVALID_DAY;
+    }
+
+    for (int j = 0; j < SCMS_SLOTS_PER_SPORT; j++) {
+        out->open[j] = !hasSlotStarted(centre, day, j + 1);
+    }
+    for (int i = 0; i < SCMS_SPORT_COUNT; i++) {
+        for (int j = 0; j < SCMS_SLOTS_PER_SPORT; j++) {
+            int booked = centre->slotCounts[day % SCMS_BOOKING_HORIZON_DAYS][i][j];
+            out->booked[i][j] = booked;
+            out->available[i][j] = out->open[j] && booked < SCMS_MAX_CUSTOMERS_PER_SLOT
+                                       ? SCMS_MAX_CUSTOMERS_PER_SLOT - booked : 0;
+        }
+    }
+    return SCMS_OK;
+}
+
+ScmsStatus scmsAdvanceClock(struct SportsCentre* centre, ScmsTime now, int* retired) {
+    if (now < centre->now) {
+        return SCMS_ERR_INVALID_ARGUMENT;
+    }
+
+    int retiredCount = 0;
+    bool archiveFailed = false;
+    while (centre->now < now) {
+        if (centre->liveBookings == 0) {
+            // Nothing left to expire: jump straight to now, clearing the
+            // capacity rows of every day that rolled over on the way.
+            int fromDay = scmsCurrentDay(centre);
+            centre->now = now;
+            int toDay = scmsCurrentDay(centre);
+            if (toDay - fromDay >= SCMS_BOOKING_HORIZON_DAYS) {
+                memset(centre->slotCounts, 0, sizeof(centre->slotCounts));
+            } else {
+                for (int day = fromDay; day < toDay; day++) {
+                    memset(centre->slotCounts[day % SCMS_BOOKING_HORIZON_DAYS], 0,
+                           sizeof(centre->slotCounts[0]));
+                }
+            }
+            break;
+        }
+
+        centre->now++;
+        int hour = (int)(centre->now % SCMS_HOURS_PER_DAY);
+        if (hour == 0) {
+            rollOverDay(centre);
+        }
+        retiredCount += retireBucket(centre, &centre->hourWheel[hour], &archiveFailed);
+    }
+
+    if (retired != NULL) {
+        *retired = retiredCount;
+    }
+    return archiveFailed ? SCMS_ERR_NO_MEMORY : SCMS_OK;
+}
+
+int scmsCurrentDay(const struct SportsCentre* centre) {
+    return (int)(centre->now / SCMS_HOURS_PER_DAY);
+}
+
+const char* scmsStatusMessage(ScmsStatus status) {
+    switch (status) {
+        case SCMS_OK: return "Success";
+        case SCMS_ERR_NO_MEMORY: return "Memory allocation error";
+        case SCMS_ERR_INVALID_ARGUMENT: return "Invalid argument";
+        case SCMS_ERR_INVALID_SPORT: return "Invalid sport number";
+        case SCMS_ERR_INVALID_SLOT: return "Invalid time slot";
+        case SCMS_ERR_INVALID_DAY: return "Day is outside the booking window";
+        case SCMS_ERR_SLOT_PASSED: return "Time slot has already started";
+        case SCMS_ERR_INVALID_EMAIL: return "Invalid email format";
+        case SCMS_ERR_INVALID_PHONE: return "Invalid phone number format";
+        case SCMS_ERR_INVALID_ADDRESS: return "Invalid address format";
+        case SCMS_ERR_CUSTOMER_EXISTS: return "Customer already exists";
+        case SCMS_ERR_CUSTOMER_NOT_FOUND: return "Customer not found";
+        case SCMS_ERR_SLOT_FULL: return "Time slot is fully booked";
+        case SCMS_ERR_DUPLICATE_SPORT: return "Customer already has a booking in this sport";
+        case SCMS_ERR_BOOKING_NOT_FOUND: return "Booking not found";
+        default: return "Unknown error";
+    }
+}
+
+const char* sportName(int sport) {
+    switch (sport) {
+        case 1: return "Tennis";
+        case 2: return "Basketball";
+        case 3: return "Swimming";
+        case 4: return "Football";
+        case 5: return "Badminton";
+        case 6: return "Table Tennis";
+        default: return "Unknown";
+    }
+}
+
+int slotStartHour(int timeSlot) {
+    return SCMS_OPENING_HOUR + (timeSlot - 1) * SCMS_SLOT_DURATION;
+}
+
+int slotEndHour(int timeSlot) {
+    return slotStartHour(timeSlot) + SCMS_SLOT_DURATION;
+}
+
+// Helper function for case-insensitive string comparison
+int stringCompareIgnoreCase(const char* str1, const char* str2) {
+    while (*str1 && *str2) {
+        char c1 = tolower((unsigned char)*str1);
+        char c2 = tolower((unsigned char)*str2);
+        if (c1 != c2) {
+            return c1 - c2;
+        }
+        str1++;
+        str2++;
+    }
+    return tolower((unsigned char)*str1) - tolower((unsigned char)*str2);
+}
+
+struct Customer* findCustomerByName(struct Customer* head, const char* name) {
+    struct Customer* current = head;
+    while (current != NULL) {
+        if (stringCompareIgnoreCase(current->name, name) == 0) {
+            return current;
+        }
+        current = current->next;
+    }
+    return NULL;
+}
+
+struct Customer* findCustomerById(struct Customer* head, int id) {
+    struct Customer* current = head;
+    while (current != NULL) {
+        if (current->customerId == id) {
+            return current;
+        }
+        current = current->next;
+    }
+    return NULL;
+}
+
+bool hasBookingInSport(struct Booking* bookingHead, int customerId, int day, int sport) {
+    struct Booking* current = bookingHead;
+    while (current != NULL) {
+        if (current->customerId == customerId && current->day == day && current->sport == sport) {
+            return true;
+        }
+        current = current->next;
+    }
+    return false;
+}
+
+bool isValidEmail(const char *email) {
+    return strchr(email, '@') != NULL && strchr(email, '.') != NULL;
+}
+
+bool isValidPhoneNumber(const char *phoneNumber) {
+    int digitCount = 0;
+    while (*phoneNumber) {
+        if (isdigit((unsigned char)*phoneNumber)) {
+            digitCount++;
+        }
+        phoneNumber++;
+    }
+    return digitCount == 10;
+}
+
+bool isValidAddress(const char *address) {
+    bool hasLetter = false;
+    bool hasDigit = false;
+    while (*address) {
+        if (isalpha((unsigned char)*address)) {
+            hasLetter = true;
+        } else if (isdigit((unsigned char)*address)) {
+            hasDigit = true;
+        }
+        address++;
+    }
+    return hasLetter && hasDigit;
+}
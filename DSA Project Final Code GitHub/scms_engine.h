@@ -0,0 +1,141 @@
+#ifndef SCMS_ENGINE_H
+#define SCMS_ENGINE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// Sports Center Management System - core engine.
+// Every function here is pure business logic: no stdio, no prompting.
+// Results are reported through ScmsStatus codes and output parameters.
+
+#define SCMS_NAME_LEN 50
+#define SCMS_EMAIL_LEN 50
+#define SCMS_PHONE_LEN 15
+#define SCMS_ADDRESS_LEN 100
+
+#define SCMS_SPORT_COUNT 6
+#define SCMS_SLOTS_PER_SPORT 6
+#define SCMS_MAX_CUSTOMERS_PER_SLOT 3
+#define SCMS_OPENING_HOUR 8
+#define SCMS_CLOSING_HOUR 20
+#define SCMS_SLOT_DURATION 2
+
+#define SCMS_HOURS_PER_DAY 24
+// Bookings may be made for today and the next SCMS_BOOKING_HORIZON_DAYS - 1 days
+#define SCMS_BOOKING_HORIZON_DAYS 16
+
+// Engine clock: hours since hour 0 of day 0. The caller decides what day 0 is.
+typedef long ScmsTime;
+
+typedef enum {
+    SCMS_OK = 0,
+    SCMS_ERR_NO_MEMORY,
+    SCMS_ERR_INVALID_ARGUMENT,
+    SCMS_ERR_INVALID_SPORT,
+    SCMS_ERR_INVALID_SLOT,
+    SCMS_ERR_INVALID_DAY,
+    SCMS_ERR_SLOT_PASSED,
+    SCMS_ERR_INVALID_EMAIL,
+    SCMS_ERR_INVALID_PHONE,
+    SCMS_ERR_INVALID_ADDRESS,
+    SCMS_ERR_CUSTOMER_EXISTS,
+    SCMS_ERR_CUSTOMER_NOT_FOUND,
+    SCMS_ERR_SLOT_FULL,
+    SCMS_ERR_DUPLICATE_SPORT,
+    SCMS_ERR_BOOKING_NOT_FOUND
+} ScmsStatus;
+
+struct Customer {
+    int customerId;
+    char name[SCMS_NAME_LEN];
+    char email[SCMS_EMAIL_LEN];
+    char phoneNumber[SCMS_PHONE_LEN];
+    char address[SCMS_ADDRESS_LEN];
+    int age;
+    struct Customer* next;
+};
+
+struct Booking {
+    int bookingId;
+    int customerId;
+    int day;
+    int sport;
+    int timeSlot;
+    struct Booking* prev;
+    struct Booking* next;
+    struct Booking* timerPrev; // Links within the expiry wheel bucket
+    struct Booking* timerNext;
+};
+
+// Compact copy of a booking whose slot has been played
+struct BookingRecord {
+    int bookingId;
+    int customerId;
+    int day;
+    unsigned char sport;
+    unsigned char timeSlot;
+};
+
+struct BookingArchive {
+    struct BookingRecord* records;
+    size_t count;
+    size_t capacity;
+};
+
+// All state of one sports centre. Lists may be walked read-only by clients;
+// mutate only through the scms* functions so the slot counters stay in sync.
+// bookingHead holds upcoming bookings only; finished ones are retired into
+// the archive by a two-level timer wheel (hours of today, then days ahead).
+struct SportsCentre {
+    struct Customer* customerHead;
+    struct Customer* customerTail;
+    struct Booking* bookingHead;
+    struct Booking* bookingTail;
+    unsigned int lastCustomerId;
+    int lastBookingId;
+    ScmsTime now;
+    int liveBookings;
+    // [day % horizon][sport][timeSlot]; a day's row is cleared when it rolls over
+    int slotCounts[SCMS_BOOKING_HORIZON_DAYS][SCMS_SPORT_COUNT][SCMS_SLOTS_PER_SPORT];
+    struct Booking* hourWheel[SCMS_HOURS_PER_DAY];      // Today's bookings by end hour
+    struct Booking* dayWheel[SCMS_BOOKING_HORIZON_DAYS]; // Later bookings by day % horizon
+    struct BookingArchive archive;
+};
+
+struct SlotAvailability {
+    bool open[SCMS_SLOTS_PER_SPORT]; // false once the slot has started
+    int booked[SCMS_SPORT_COUNT][SCMS_SLOTS_PER_SPORT];
+    int available[SCMS_SPORT_COUNT][SCMS_SLOTS_PER_SPORT];
+};
+
+void scmsInit(struct SportsCentre* centre);
+void scmsFree(struct SportsCentre* centre);
+
+ScmsStatus scmsRegisterCustomer(struct SportsCentre* centre, const char* name, const char* email,
+                                const char* phoneNumber, const char* address, int age,
+                                struct Customer** registered);
+ScmsStatus scmsDeleteCustomer(struct SportsCentre* centre, const char* name, int* deletedBookings);
+ScmsStatus scmsBookSlot(struct SportsCentre* centre, int customerId, int day, int sport, int timeSlot,
+                        struct Booking** booked);
+// On success *cancelled receives a copy of the removed booking with its links cleared.
+ScmsStatus scmsCancelBooking(struct SportsCentre* centre, int customerId, int bookingId,
+                             struct Booking* cancelled);
+ScmsStatus scmsGetAvailability(const struct SportsCentre* centre, int day, struct SlotAvailability* out);
+// Moves the clock forward to now, retiring every booking whose slot has ended.
+// *retired (optional) receives the number of bookings moved to the archive.
+ScmsStatus scmsAdvanceClock(struct SportsCentre* centre, ScmsTime now, int* retired);
+int scmsCurrentDay(const struct SportsCentre* centre);
+const char* scmsStatusMessage(ScmsStatus status);
+
+const char* sportName(int sport);
+int slotStartHour(int timeSlot);
+int slotEndHour(int timeSlot);
+int stringCompareIgnoreCase(const char* str1, const char* str2);
+struct Customer* findCustomerByName(struct Customer* head, const char* name);
+struct Customer* findCustomerById(struct Customer* head, int id);
+bool hasBookingInSport(struct Booking* bookingHead, int customerId, int day, int sport);
+bool isValidEmail(const char *email);
+bool isValidPhoneNumber(const char *phoneNumber);
+bool isValidAddress(const char *address);
+
+#endif
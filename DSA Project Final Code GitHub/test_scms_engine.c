@@ -0,0 +1,195 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "scms_engine.h"
+
+static int failures = 0;
+
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            printf("FAILED %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+            failures++; \
+        } \
+    } while (0)
+
+static int addTestCustomer(struct SportsCentre* centre, const char* name) {
+    struct Customer* customer = NULL;
+    ScmsStatus status = scmsRegisterCustomer(centre, name, "user@example.com", "9876543210", "12 Main Road", 25, &customer);
+    CHECK(status == SCMS_OK);
+    return customer != NULL ? customer->customerId : -1;
+}
+
+static void testValidation(void) {
+    CHECK(isValidEmail("a@b.c"));
+    CHECK(!isValidEmail("abc"));
+    CHECK(isValidPhoneNumber("98765-43210"));
+    CHECK(!isValidPhoneNumber("12345"));
+    CHECK(isValidAddress("12 Main Road"));
+    CHECK(!isValidAddress("Main Road"));
+    CHECK(strcmp(sportName(6), "Table Tennis") == 0);
+    CHECK(slotStartHour(1) == 8 && slotEndHour(6) == 20);
+}
+
+static void testRegisterCustomer(void) {
+    struct SportsCentre centre;
+    scmsInit(&centre);
+
+    CHECK(addTestCustomer(&centre, "Asha") == 1);
+    CHECK(addTestCustomer(&centre, "Ravi") == 2);
+    CHECK(scmsRegisterCustomer(&centre, "ASHA", "x@y.z", "9876543210", "1 Road", 30, NULL) == SCMS_ERR_CUSTOMER_EXISTS);
+    CHECK(scmsRegisterCustomer(&centre, "Meena", "bad", "9876543210", "1 Road", 30, NULL) == SCMS_ERR_INVALID_EMAIL);
+    CHECK(scmsRegisterCustomer(&centre, "Meena", "x@y.z", "98", "1 Road", 30, NULL) == SCMS_ERR_INVALID_PHONE);
+    CHECK(scmsRegisterCustomer(&centre, "Meena", "x@y.z", "9876543210", "Road", 30, NULL) == SCMS_ERR_INVALID_ADDRESS);
+    CHECK(findCustomerById(centre.customerHead, 2) == findCustomerByName(centre.customerHead, "ravi"));
+
+    scmsFree(&centre);
+}
+
+static void testBookingRules(void) {
+    struct SportsCentre centre;
+    scmsInit(&centre);
+
+    int ids[4];
+    ids[0] = addTestCustomer(&centre, "A");
+    ids[1] = addTestCustomer(&centre, "B");
+    ids[2] = addTestCustomer(&centre, "C");
+    ids[3] = addTestCustomer(&centre, "D");
+
+    struct Booking* booking = NULL;
+    CHECK(scmsBookSlot(&centre, ids[0], 0, 1, 1, &booking) == SCMS_OK);
+    CHECK(booking != NULL && booking->bookingId == 1);
+    CHECK(scmsBookSlot(&centre, ids[0], 0, 1, 2, NULL) == SCMS_ERR_DUPLICATE_SPORT);
+    CHECK(scmsBookSlot(&centre, ids[0], 0, 2, 1, NULL) == SCMS_OK);
+    CHECK(scmsBookSlot(&centre, ids[1], 0, 1, 1, NULL) == SCMS_OK);
+    CHECK(scmsBookSlot(&centre, ids[2], 0, 1, 1, NULL) == SCMS_OK);
+    CHECK(scmsBookSlot(&centre, ids[3], 0, 1, 1, NULL) == SCMS_ERR_SLOT_FULL);
+    CHECK(scmsBookSlot(&centre, ids[3], 0, 0, 1, NULL) == SCMS_ERR_INVALID_SPORT);
+    CHECK(scmsBookSlot(&centre, ids[3], 0, 1, 7, NULL) == SCMS_ERR_INVALID_SLOT);
+    CHECK(scmsBookSlot(&centre, 99, 0, 1, 2, NULL) == SCMS_ERR_CUSTOMER_NOT_FOUND);
+
+    struct SlotAvailability availability;
+    scmsGetAvailability(&centre, 0, &availability);
+    CHECK(availability.booked[0][0] == 3 && availability.available[0][0] == 0);
+    CHECK(availability.booked[1][0] == 1 && availability.available[1][0] == 2);
+
+    scmsFree(&centre);
+}
+
+static void testCancelAndDelete(void) {
+    struct SportsCentre centre;
+    scmsInit(&centre);
+
+    int asha = addTestCustomer(&centre, "Asha");
+    int ravi = addTestCustomer(&centre, "Ravi");
+    struct Booking* first = NULL;
+    struct Booking* last = NULL;
+    CHECK(scmsBookSlot(&centre, asha, 0, 1, 3, &first) == SCMS_OK);
+    CHECK(scmsBookSlot(&centre, ravi, 0, 1, 3, NULL) == SCMS_OK);
+    CHECK(scmsBookSlot(&centre, asha, 0, 2, 3, &last) == SCMS_OK);
+    int firstId = first->bookingId;
+    int lastId = last->bookingId;
+
+    struct Booking cancelled;
+    CHECK(scmsCancelBooking(&centre, ravi, firstId, &cancelled) == SCMS_ERR_BOOKING_NOT_FOUND);
+    CHECK(scmsCancelBooking(&centre, asha, lastId, &cancelled) == SCMS_OK);
+    CHECK(cancelled.sport == 2 && cancelled.timeSlot == 3 && cancelled.next == NULL);
+    CHECK(!hasBookingInSport(centre.bookingHead, asha, 0, 2));
+
+    // Tail must be maintained so appends after removing the last booking still work
+    CHECK(scmsBookSlot(&centre, asha, 0, 2, 4, NULL) == SCMS_OK);
+    CHECK(hasBookingInSport(centre.bookingHead, asha, 0, 2));
+
+    int deletedBookings = 0;
+    CHECK(scmsDeleteCustomer(&centre, "asha", &deletedBookings) == SCMS_OK);
+    CHECK(deletedBookings == 2);
+    CHECK(findCustomerByName(centre.customerHead, "Asha") == NULL);
+    CHECK(scmsDeleteCustomer(&centre, "Asha", NULL) == SCMS_ERR_CUSTOMER_NOT_FOUND);
+
+    struct SlotAvailability availability;
+    scmsGetAvailability(&centre, 0, &availability);
+    CHECK(availability.booked[0][2] == 1);
+    CHECK(availability.booked[1][3] == 0);
+
+    CHECK(scmsDeleteCustomer(&centre, "Ravi", NULL) == SCMS_OK);
+    CHECK(centre.customerHead == NULL && centre.bookingHead == NULL);
+    CHECK(addTestCustomer(&centre, "Kiran") == 3);
+
+    scmsFree(&centre);
+}
+
+static void testBookingExpiry(void) {
+    struct SportsCentre centre;
+    scmsInit(&centre);
+
+    int asha = addTestCustomer(&centre, "Asha");
+    int ravi = addTestCustomer(&centre, "Ravi");
+    int retired = -1;
+
+    // Day 0, 09:00: the 08:00 slot has started, the 10:00 slot has not
+    CHECK(scmsAdvanceClock(&centre, 9, &retired) == SCMS_OK && retired == 0);
+    CHECK(scmsBookSlot(&centre, asha, 0, 1, 1, NULL) == SCMS_ERR_SLOT_PASSED);
+    CHECK(scmsBookSlot(&centre, asha, 0, 1, 2, NULL) == SCMS_OK);
+    CHECK(scmsBookSlot(&centre, asha, 1, 1, 1, NULL) == SCMS_OK);
+    CHECK(scmsBookSlot(&centre, ravi, 2, 3, 6, NULL) == SCMS_OK);
+    CHECK(scmsBookSlot(&centre, ravi, 0, 2, 6, NULL) == SCMS_OK);
+    CHECK(scmsBookSlot(&centre, ravi, SCMS_BOOKING_HORIZON_DAYS, 1, 1, NULL) == SCMS_ERR_INVALID_DAY);
+    CHECK(centre.liveBookings == 4);
+
+    struct SlotAvailability availability;
+    CHECK(scmsGetAvailability(&centre, 0, &availability) == SCMS_OK);
+    CHECK(!availability.open[0] && availability.available[0][0] == 0);
+    CHECK(availability.open[1] && availability.available[0][1] == 2);
+    CHECK(scmsGetAvailability(&centre, -1, &availability) == SCMS_ERR_INVALID_DAY);
+
+    // A cancelled booking leaves the wheel and is never archived
+    struct Booking cancelled;
+    CHECK(scmsCancelBooking(&centre, ravi, 4, &cancelled) == SCMS_OK);
+    CHECK(cancelled.day == 0 && cancelled.timerNext == NULL);
+
+    // 12:00: the 10:00 - 12:00 tennis booking has been played
+    CHECK(scmsAdvanceClock(&centre, 12, &retired) == SCMS_OK && retired == 1);
+    CHECK(centre.liveBookings == 2 && centre.archive.count == 1);
+    CHECK(centre.archive.records[0].bookingId == 1 && centre.archive.records[0].day == 0);
+    CHECK(!hasBookingInSport(centre.bookingHead, asha, 0, 1));
+    CHECK(scmsAdvanceClock(&centre, 11, NULL) == SCMS_ERR_INVALID_ARGUMENT);
+
+    // Day 1 rolls over: day 0's counters are cleared and day 1's booking is cascaded
+    CHECK(scmsAdvanceClock(&centre, 24, &retired) == SCMS_OK && retired == 0);
+    CHECK(scmsCurrentDay(&centre) == 1);
+    CHECK(scmsGetAvailability(&centre, 1, &availability) == SCMS_OK && availability.booked[0][0] == 1);
+    CHECK(scmsGetAvailability(&centre, SCMS_BOOKING_HORIZON_DAYS, &availability) == SCMS_OK);
+    CHECK(availability.booked[0][1] == 0);
+    CHECK(scmsAdvanceClock(&centre, 24 + 10, &retired) == SCMS_OK && retired == 1);
+
+    // Day 2's booking ends at 20:00; a long jump afterwards skips straight ahead
+    CHECK(scmsAdvanceClock(&centre, 24 * 365, &retired) == SCMS_OK && retired == 1);
+    CHECK(centre.liveBookings == 0 && centre.bookingHead == NULL && centre.bookingTail == NULL);
+    CHECK(centre.archive.count == 3 && centre.archive.records[2].sport == 3);
+    CHECK(scmsCurrentDay(&centre) == 365);
+
+    // Capacity for the new horizon starts empty and bookings still work after the jump
+    for (int day = 365; day < 365 + SCMS_BOOKING_HORIZON_DAYS; day++) {
+        CHECK(scmsGetAvailability(&centre, day, &availability) == SCMS_OK);
+        CHECK(availability.booked[0][1] == 0 && availability.booked[2][5] == 0);
+    }
+    CHECK(scmsBookSlot(&centre, asha, 366, 1, 1, NULL) == SCMS_OK);
+    CHECK(scmsAdvanceClock(&centre, 24 * 367, &retired) == SCMS_OK && retired == 1);
+
+    scmsFree(&centre);
+}
+
+int main(void) {
+    testValidation();
+    testRegisterCustomer();
+    testBookingRules();
+    testCancelAndDelete();
+    testBookingExpiry();
+
+    if (failures != 0) {
+        printf("%d check(s) failed.\n", failures);
+        return 1;
+    }
+    printf("All engine tests passed.\n");
+    return 0;
+}